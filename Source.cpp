@@ -1,35 +1,48 @@
 #include <iostream>
 #include <queue>
-#include <climits>
 #include <map>
 #include <set>
 #include <algorithm>
 #include <fstream>
 #include <string>
 #include <chrono> // For measuring algorithm runtimes
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 using namespace std;
 
-const int MAX_VERTICES = 20; // Total number of students and teachers (assuming 10 students and 10 teachers)
-const int INF = INT_MAX;
 map<string, long long> algorithmRuntimes; // Stores runtimes for algorithms
 
+// Accumulated path length type: 64-bit for integer weights so dist[u] + weight cannot overflow,
+// double for floating point weights
+template <typename Weight>
+using DistanceOf = conditional_t<is_floating_point_v<Weight>, double,
+                                 conditional_t<is_signed_v<Weight>, int64_t, uint64_t>>;
+
+template <typename VertexId, typename Weight>
 struct Node
 {
-    int vertex, weight;
-    Node *next;
+    VertexId vertex;
+    Weight weight;
 
-    Node(int v, int w) : vertex(v), weight(w), next(nullptr) {}
+    Node(VertexId v, Weight w) : vertex(v), weight(w) {}
 };
 
+template <typename VertexId, typename Weight>
 struct Edge
 {
-    int src, dest, weight;
+    VertexId src, dest;
+    Weight weight;
 };
 
 struct Subset
 {
-    int parent, rank;
+    size_t parent;
+    int rank;
 };
 
 struct Teacher
@@ -46,27 +59,41 @@ struct Workshop
     Workshop(const string &n) : name(n) {}
 };
 
+template <typename VertexId = uint16_t, typename Weight = int32_t>
 class Graph
 {
-    int V;      // Number of vertices
-    Node **adj; // Adjacency list
-    Edge *edges;
-    int edgeCount;
+    static_assert(is_integral_v<VertexId> && is_unsigned_v<VertexId> && !is_same_v<VertexId, bool>, "VertexId must be an unsigned integer type");
+    static_assert(is_arithmetic_v<Weight>, "Weight must be an arithmetic type");
+
+    using Node = ::Node<VertexId, Weight>;
+    using Edge = ::Edge<VertexId, Weight>;
+    using Distance = DistanceOf<Weight>;
+
+    // Byte sized unsigned weights are few enough to keep one bucket per weight value (Dial's algorithm)
+    static constexpr bool useBucketQueue = is_integral_v<Weight> && is_unsigned_v<Weight> && sizeof(Weight) == 1;
+    static constexpr Distance INF = numeric_limits<Distance>::max();
+
+    VertexId V;               // Number of vertices
+    vector<vector<Node>> adj; // Adjacency list, stored contiguously so compact ids and weights pack per edge
+    vector<Edge> edges;
 
 public:
-    map<int, string> studentNames;
+    using VertexIdType = VertexId;
+
+    map<VertexId, string> studentNames;
     Teacher *teachers;
     map<string, string> teacherStudentMap; // Map to store teacher-student relationships
     Workshop *workshops;
-    map<int, string> workshopSchedule;             // Map to store workshop schedule for students
-    map<int, string> workshopEnrollments;          // Map to store workshop enrollments for students
-    map<int, set<int>> studentWorkshopEnrollments; // Map to store workshop enrollments for students
-    Graph(int numStudents, int numTeachers) : V(numStudents + numTeachers), edgeCount(0)
-    {
-        adj = new Node *[V];
-        edges = new Edge[50];
-        for (int i = 0; i < V; ++i)
-            adj[i] = nullptr;
+    map<VertexId, string> workshopSchedule;             // Map to store workshop schedule for students
+    map<VertexId, string> workshopEnrollments;          // Map to store workshop enrollments for students
+    map<VertexId, set<int>> studentWorkshopEnrollments; // Map to store workshop enrollments for students
+    Graph(size_t numStudents, size_t numTeachers)
+    {
+        if (numStudents + numTeachers > numeric_limits<VertexId>::max())
+            throw length_error("Too many students and teachers for the graph's vertex id type");
+
+        V = static_cast<VertexId>(numStudents + numTeachers);
+        adj.resize(V);
         initializeStudentNames();
         teachers = new Teacher[numTeachers];
         initializeTeacherNames();
@@ -76,18 +103,6 @@ public:
 
     ~Graph()
     {
-        for (int i = 0; i < V; ++i)
-        {
-            Node *temp = adj[i];
-            while (temp != nullptr)
-            {
-                Node *next = temp->next;
-                delete temp;
-                temp = next;
-            }
-        }
-        delete[] adj;
-        delete[] edges;
         delete[] teachers;
         delete[] workshops;
     }
@@ -126,7 +141,7 @@ public:
 
     void printGraph()
     {
-        for (int v = 0; v < V; ++v)
+        for (VertexId v = 0; v < V; ++v)
         {
             if (v < 10)
             {
@@ -141,46 +156,44 @@ public:
                 }
             }
 
-            Node *crawl = adj[v];
-            while (crawl)
+            for (const Node &crawl : adj[v])
             {
-                if (crawl->vertex < 10)
-                    cout << "\t" << studentNames[crawl->vertex] << " (Strength: " << crawl->weight << ")\n";
+                if (crawl.vertex < 10)
+                    cout << "\t" << studentNames[crawl.vertex] << " (Strength: " << +crawl.weight << ")\n";
                 else
-                    cout << "\t" << teachers[crawl->vertex - 10].name << " (Strength: " << crawl->weight << ")\n";
-                crawl = crawl->next;
+                    cout << "\t" << teachers[crawl.vertex - 10].name << " (Strength: " << +crawl.weight << ")\n";
             }
             cout << endl;
         }
     }
 
-    void addEdge(int u, int v, int w)
+    void addEdge(VertexId u, VertexId v, Weight w)
     {
-        Node *node = new Node(v, w);
-        node->next = adj[u];
-        adj[u] = node;
-
-        node = new Node(u, w);
-        node->next = adj[v];
-        adj[v] = node;
+        adj[u].emplace_back(v, w);
+        adj[v].emplace_back(u, w);
 
-        edges[edgeCount++] = {u, v, w};
+        edges.push_back({u, v, w});
     }
 
-    void dijkstra(int src);
-    int find(Subset subsets[], int i);
-    void Union(Subset subsets[], int x, int y);
+    void dijkstra(VertexId src);
+    size_t find(Subset subsets[], size_t i);
+    void Union(Subset subsets[], size_t x, size_t y);
     void kruskalMST();
-    void BFS(int startVertex, bool showTeacherConnections);
-    void scheduleWorkshop(int studentIndex, int workshopIndex);
+    void BFS(VertexId startVertex, bool showTeacherConnections);
+    void scheduleWorkshop(VertexId studentIndex, int workshopIndex);
     void printWorkshopSchedule();
+    optional<VertexId> findVertexByName(const string &name);
     void searchByName(const string &name);
     void searchStudentsInWorkshop(int workshopIndex); // Added for workshop search
-    void DFSStudentsInWorkshop(int v, int workshopIndex, bool visited[]);
+    void DFSStudentsInWorkshop(VertexId v, int workshopIndex, bool visited[]);
     void exportGraphData();
 };
 
-int Graph::find(Subset subsets[], int i)
+using ClassroomGraph = Graph<uint16_t, uint8_t>; // Small cohorts with friendship strengths 0-255
+using NetworkGraph = Graph<uint64_t, int32_t>;   // Large networks with 64-bit ids and distances
+
+template <typename VertexId, typename Weight>
+size_t Graph<VertexId, Weight>::find(Subset subsets[], size_t i)
 {
     if (subsets[i].parent != i)
     {
@@ -189,12 +202,13 @@ int Graph::find(Subset subsets[], int i)
     return subsets[i].parent;
 }
 
-void Graph::exportGraphData()
+template <typename VertexId, typename Weight>
+void Graph<VertexId, Weight>::exportGraphData()
 {
     ofstream outFile("graph_data.json");
     outFile << "{" << endl;
     outFile << "\"nodes\": [" << endl;
-    for (int i = 0; i < V; ++i)
+    for (VertexId i = 0; i < V; ++i)
     {
         outFile << "{ \"id\": " << i;
         outFile << ", \"label\": \"" << ((i < 10) ? studentNames[i] : teachers[i - 10].name) << "\"}";
@@ -205,10 +219,10 @@ void Graph::exportGraphData()
     outFile << "]," << endl;
 
     outFile << "\"edges\": [" << endl;
-    for (int i = 0; i < edgeCount; ++i)
+    for (size_t i = 0; i < edges.size(); ++i)
     {
-        outFile << "{ \"from\": " << edges[i].src << ", \"to\": " << edges[i].dest << ", \"weight\": " << edges[i].weight << "}";
-        if (i < edgeCount - 1)
+        outFile << "{ \"from\": " << edges[i].src << ", \"to\": " << edges[i].dest << ", \"weight\": " << +edges[i].weight << "}";
+        if (i < edges.size() - 1)
             outFile << ",";
         outFile << endl;
     }
@@ -217,10 +231,11 @@ void Graph::exportGraphData()
     outFile.close();
 }
 
-void Graph::Union(Subset subsets[], int x, int y)
+template <typename VertexId, typename Weight>
+void Graph<VertexId, Weight>::Union(Subset subsets[], size_t x, size_t y)
 {
-    int xroot = find(subsets, x);
-    int yroot = find(subsets, y);
+    size_t xroot = find(subsets, x);
+    size_t yroot = find(subsets, y);
 
     if (subsets[xroot].rank < subsets[yroot].rank)
     {
@@ -237,31 +252,32 @@ void Graph::Union(Subset subsets[], int x, int y)
     }
 }
 
-void Graph::kruskalMST()
+template <typename VertexId, typename Weight>
+void Graph<VertexId, Weight>::kruskalMST()
 {
 
     auto start = chrono::high_resolution_clock::now();
-    Edge result[MAX_VERTICES]; // Store result
-    int e = 0;                 // Index variable for result
+    vector<Edge> result(V > 0 ? V - 1 : 0); // Store result
+    size_t e = 0;                           // Index variable for result
 
     // Step 1: Sort all the edges in non-decreasing order of their weight
-    sort(edges, edges + edgeCount, [](Edge a, Edge b)
+    sort(edges.begin(), edges.end(), [](const Edge &a, const Edge &b)
          { return a.weight < b.weight; });
 
     Subset *subsets = new Subset[V];
-    for (int v = 0; v < V; ++v)
+    for (VertexId v = 0; v < V; ++v)
     {
         subsets[v].parent = v;
         subsets[v].rank = 0;
     }
 
-    int i = 0; // Index used to pick next edge
-    while (e < V - 1 && i < edgeCount)
+    size_t i = 0; // Index used to pick next edge
+    while (e < result.size() && i < edges.size())
     {
         Edge next_edge = edges[i++];
 
-        int x = find(subsets, next_edge.src);
-        int y = find(subsets, next_edge.dest);
+        size_t x = find(subsets, next_edge.src);
+        size_t y = find(subsets, next_edge.dest);
 
         if (x != y)
         {
@@ -271,9 +287,9 @@ void Graph::kruskalMST()
     }
 
     // Print the result
-    for (i = 0; i < e; ++i)
+    for (size_t r = 0; r < e; ++r)
     {
-        cout << studentNames[result[i].src] << " -- " << studentNames[result[i].dest] << " == " << result[i].weight << endl;
+        cout << studentNames[result[r].src] << " -- " << studentNames[result[r].dest] << " == " << +result[r].weight << endl;
     }
 
     delete[] subsets;
@@ -282,33 +298,77 @@ void Graph::kruskalMST()
     algorithmRuntimes["Kruskal"] += chrono::duration_cast<chrono::milliseconds>(end - start).count();
 }
 
-void Graph::dijkstra(int src)
+template <typename VertexId, typename Weight>
+void Graph<VertexId, Weight>::dijkstra(VertexId src)
 {
     auto start = chrono::high_resolution_clock::now();
 
-    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq;
-    vector<int> dist(V, INF);
-
-    pq.push(make_pair(0, src));
+    vector<Distance> dist(V, INF);
     dist[src] = 0;
 
-    while (!pq.empty())
+    if constexpr (useBucketQueue)
+    {
+        // Dial's algorithm: every tentative distance lies within maxWeight of the current one,
+        // so maxWeight + 1 circular buckets replace the binary heap
+        const size_t numBuckets = size_t(numeric_limits<Weight>::max()) + 1;
+        vector<vector<VertexId>> buckets(numBuckets);
+
+        buckets[0].push_back(src);
+        size_t pending = 1;
+
+        for (Distance current = 0; pending > 0; ++current)
+        {
+            vector<VertexId> &bucket = buckets[current % numBuckets];
+            while (!bucket.empty())
+            {
+                VertexId u = bucket.back();
+                bucket.pop_back();
+                --pending;
+
+                if (dist[u] != current) // Stale entry
+                    continue;
+
+                for (const Node &node : adj[u])
+                {
+                    VertexId v = node.vertex;
+                    Distance candidate = current + node.weight;
+
+                    if (dist[v] > candidate)
+                    {
+                        dist[v] = candidate;
+                        buckets[candidate % numBuckets].push_back(v);
+                        ++pending;
+                    }
+                }
+            }
+        }
+    }
+    else
     {
-        int u = pq.top().second;
-        pq.pop();
+        priority_queue<pair<Distance, VertexId>, vector<pair<Distance, VertexId>>, greater<pair<Distance, VertexId>>> pq;
 
-        Node *node = adj[u];
-        while (node != nullptr)
+        pq.push(make_pair(Distance(0), src));
+
+        while (!pq.empty())
         {
-            int v = node->vertex;
-            int weight = node->weight;
+            Distance d = pq.top().first;
+            VertexId u = pq.top().second;
+            pq.pop();
+
+            if (d > dist[u]) // Stale entry, u was already settled with a shorter distance
+                continue;
 
-            if (dist[v] > dist[u] + weight)
+            for (const Node &node : adj[u])
             {
-                dist[v] = dist[u] + weight;
-                pq.push(make_pair(dist[v], v));
+                VertexId v = node.vertex;
+                Distance candidate = dist[u] + node.weight;
+
+                if (dist[v] > candidate)
+                {
+                    dist[v] = candidate;
+                    pq.push(make_pair(dist[v], v));
+                }
             }
-            node = node->next;
         }
     }
 
@@ -317,31 +377,37 @@ void Graph::dijkstra(int src)
     else
         cout << "Shortest path distances from " << teachers[src - 10].name << ":\n";
 
-    for (int i = 0; i < V; ++i)
+    for (VertexId i = 0; i < V; ++i)
     {
         if (i < 10)
-            cout << "To " << studentNames[i] << ":\t" << dist[i] << " units\n";
+            cout << "To " << studentNames[i] << ":\t";
+        else
+            cout << "To " << teachers[i - 10].name << ":\t";
+
+        if (dist[i] == INF)
+            cout << "unreachable\n";
         else
-            cout << "To " << teachers[i - 10].name << ":\t" << dist[i] << " units\n";
+            cout << dist[i] << " units\n";
     }
 
     auto end = chrono::high_resolution_clock::now();
     algorithmRuntimes["Dijkstra"] += chrono::duration_cast<chrono::milliseconds>(end - start).count();
 }
 
-void Graph::BFS(int startVertex, bool showTeacherConnections)
+template <typename VertexId, typename Weight>
+void Graph<VertexId, Weight>::BFS(VertexId startVertex, bool showTeacherConnections)
 {
     auto start = chrono::high_resolution_clock::now();
 
     // Create an array to keep track of visited students and teachers
     bool *visited = new bool[V];
-    for (int i = 0; i < V; ++i)
+    for (VertexId i = 0; i < V; ++i)
     {
         visited[i] = false;
     }
 
     // Create a queue for BFS
-    queue<int> bfsQueue;
+    queue<VertexId> bfsQueue;
 
     // Mark the current student or teacher as visited and enqueue them
     visited[startVertex] = true;
@@ -359,13 +425,12 @@ void Graph::BFS(int startVertex, bool showTeacherConnections)
 
     while (!bfsQueue.empty())
     {
-        int currentVertex = bfsQueue.front();
+        VertexId currentVertex = bfsQueue.front();
         bfsQueue.pop();
 
-        Node *node = adj[currentVertex];
-        while (node != nullptr)
+        for (const Node &node : adj[currentVertex])
         {
-            int neighbor = node->vertex;
+            VertexId neighbor = node.vertex;
 
             if (!visited[neighbor])
             {
@@ -388,8 +453,6 @@ void Graph::BFS(int startVertex, bool showTeacherConnections)
                         cout << " - " << teachers[neighbor - 10].name << endl;
                 }
             }
-
-            node = node->next;
         }
     }
 
@@ -399,7 +462,8 @@ void Graph::BFS(int startVertex, bool showTeacherConnections)
     algorithmRuntimes["BFS"] += chrono::duration_cast<chrono::milliseconds>(end - start).count();
 }
 
-void Graph::scheduleWorkshop(int studentIndex, int workshopIndex)
+template <typename VertexId, typename Weight>
+void Graph<VertexId, Weight>::scheduleWorkshop(VertexId studentIndex, int workshopIndex)
 {
     if (workshopIndex >= 0 && workshopIndex < 5) // Assuming 5 workshops
     {
@@ -419,7 +483,8 @@ void Graph::scheduleWorkshop(int studentIndex, int workshopIndex)
     }
 }
 
-void Graph::printWorkshopSchedule()
+template <typename VertexId, typename Weight>
+void Graph<VertexId, Weight>::printWorkshopSchedule()
 {
     cout << "Workshop Schedule:\n";
     for (const auto &pair : workshopSchedule)
@@ -428,42 +493,43 @@ void Graph::printWorkshopSchedule()
     }
 }
 
-void Graph::searchByName(const string &name)
+template <typename VertexId, typename Weight>
+optional<VertexId> Graph<VertexId, Weight>::findVertexByName(const string &name)
 {
-    int startIndex = -1;
     for (const auto &pair : studentNames)
     {
         if (pair.second == name)
-        {
-            startIndex = pair.first;
-            break;
-        }
+            return pair.first;
     }
 
-    if (startIndex == -1)
+    for (VertexId v = 10; v < V; ++v) // Teachers follow the 10 students
     {
-        for (int i = 0; i < 10; ++i) // Assuming 10 teachers
-        {
-            if (teachers[i].name == name)
-            {
-                startIndex = i + 10; // Offset to represent teachers
-                break;
-            }
-        }
+        if (teachers[v - 10].name == name)
+            return v;
     }
 
-    if (startIndex != -1)
+    return nullopt;
+}
+
+template <typename VertexId, typename Weight>
+void Graph<VertexId, Weight>::searchByName(const string &name)
+{
+    optional<VertexId> startIndex = findVertexByName(name);
+
+    if (startIndex)
     {
         // When searching for a student, show friends only
         // When searching for a teacher, show connections (including student friends)
-        BFS(startIndex, (startIndex < 10) ? false : true);
+        BFS(*startIndex, (*startIndex < 10) ? false : true);
     }
     else
     {
         cout << "Name not found. Please enter a valid name." << endl;
     }
 }
-void Graph::DFSStudentsInWorkshop(int v, int workshopIndex, bool visited[])
+
+template <typename VertexId, typename Weight>
+void Graph<VertexId, Weight>::DFSStudentsInWorkshop(VertexId v, int workshopIndex, bool visited[])
 {
     static auto start = chrono::high_resolution_clock::now();
     static bool firstCall = true; // To capture the start time on first call
@@ -480,15 +546,13 @@ void Graph::DFSStudentsInWorkshop(int v, int workshopIndex, bool visited[])
         }
     }
 
-    Node *node = adj[v];
-    while (node != nullptr)
+    for (const Node &node : adj[v])
     {
-        int neighbor = node->vertex;
+        VertexId neighbor = node.vertex;
         if (!visited[neighbor])
         {
             DFSStudentsInWorkshop(neighbor, workshopIndex, visited);
         }
-        node = node->next;
     }
 
     if (firstCall)
@@ -499,7 +563,8 @@ void Graph::DFSStudentsInWorkshop(int v, int workshopIndex, bool visited[])
     }
 }
 
-void Graph::searchStudentsInWorkshop(int workshopIndex)
+template <typename VertexId, typename Weight>
+void Graph<VertexId, Weight>::searchStudentsInWorkshop(int workshopIndex)
 {
     if (workshopIndex >= 0 && workshopIndex < 5) // Assuming 5 workshops
     {
@@ -508,12 +573,12 @@ void Graph::searchStudentsInWorkshop(int workshopIndex)
 
         // Create an array to keep track of visited students and teachers
         bool *visited = new bool[V];
-        for (int i = 0; i < V; ++i)
+        for (VertexId i = 0; i < V; ++i)
         {
             visited[i] = false;
         }
 
-        for (int v = 0; v < V; ++v)
+        for (VertexId v = 0; v < V; ++v)
         {
             if (!visited[v] && v < 10) // Only start DFS from students
             {
@@ -529,9 +594,14 @@ void Graph::searchStudentsInWorkshop(int workshopIndex)
     }
 }
 
+// Compile every advertised vertex id / weight combination, not just the one main uses
+template class Graph<uint16_t, uint8_t>;
+template class Graph<uint64_t, int32_t>;
+template class Graph<uint32_t, float>;
+
 int main()
 {
-    Graph g(10, 5); // 10 students and 5 teachers
+    ClassroomGraph g(10, 5); // 10 students and 5 teachers
 
     g.addEdge(0, 1, 1); // Mati and Usman
     g.addEdge(0, 2, 4); // Mati and Bilal
@@ -579,31 +649,11 @@ int main()
             cout << "Enter the starting student's or teacher's name for Dijkstra's algorithm: ";
             cin >> startPerson;
 
-            int startIndex = -1;
-            for (const auto &pair : g.studentNames)
-            {
-                if (pair.second == startPerson)
-                {
-                    startIndex = pair.first;
-                    break;
-                }
-            }
+            optional<ClassroomGraph::VertexIdType> startIndex = g.findVertexByName(startPerson);
 
-            if (startIndex == -1)
+            if (startIndex)
             {
-                for (int i = 0; i < 10; ++i) // Assuming 10 teachers
-                {
-                    if (g.teachers[i].name == startPerson)
-                    {
-                        startIndex = i + 10; // Offset to represent teachers
-                        break;
-                    }
-                }
-            }
-
-            if (startIndex != -1)
-            {
-                g.dijkstra(startIndex);
+                g.dijkstra(*startIndex);
             }
             else
             {
@@ -624,7 +674,8 @@ int main()
         }
         case 4:
         {
-            int studentIndex, workshopIndex;
+            ClassroomGraph::VertexIdType studentIndex;
+            int workshopIndex;
             cout << "Enter the student index (0-9): ";
             cin >> studentIndex;
             cout << "Select a workshop (0-4): " << endl;